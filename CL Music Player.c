@@ -13,6 +13,10 @@
 #define MAX_PLAYLIST_SIZE 100
 #define MAX_HISTORY_SIZE 20
 #define PROGRESS_BAR_WIDTH 40
+#define SEEK_STEP_MS 10000
+#define KEY_EXTENDED_PREFIX 224
+#define KEY_ARROW_LEFT 75
+#define KEY_ARROW_RIGHT 77
 #define MASTER_PLAYLIST_FILE "playlists.txt"
 
 // ================== STRUCTURES & ENUMS ==================
@@ -78,6 +82,7 @@ void freePlaylist(Playlist* playlist);
 void addSong(Playlist* playlist, const char* title, const char* artist, const char* filePath);
 void removeSongFromPlaylist(Playlist* playlist, const char* title);
 PlaybackAction playSongInteractive(Song* song);
+void seekSong(long positionMs, long totalLength, bool isPaused);
 void addToHistory(Song* song);
 const char* stristr_custom(const char* haystack, const char* needle);
 int stricmp_custom(const char* s1, const char* s2);
@@ -273,6 +278,16 @@ void addToHistory(Song* song) {
 }
 
 // ================== INTERACTIVE PLAYBACK CORE ==================
+void seekSong(long positionMs, long totalLength, bool isPaused) {
+    char command[100];
+    // Stop short of the end so a seek never finishes the track on its own
+    if (positionMs < 0) positionMs = 0;
+    if (positionMs > totalLength - 1) positionMs = totalLength - 1;
+    // While paused, seek leaves the device stopped at the new position without playing any audio
+    snprintf(command, sizeof(command), isPaused ? "seek mySound to %ld" : "play mySound from %ld", positionMs);
+    mciSendStringA(command, NULL, 0, NULL);
+}
+
 PlaybackAction playSongInteractive(Song* song) {
     if (!song) return ACTION_FINISHED;
     char command[MAX_STRING_LENGTH + 100], status[MAX_STRING_LENGTH];
@@ -285,6 +300,7 @@ PlaybackAction playSongInteractive(Song* song) {
         Sleep(2500);
         return ACTION_NEXT;
     }
+    mciSendStringA("set mySound time format milliseconds", NULL, 0, NULL);
     mciSendStringA("status mySound length", status, sizeof(status), NULL);
     totalLength = atol(status);
     if (totalLength <= 0) {
@@ -296,12 +312,20 @@ PlaybackAction playSongInteractive(Song* song) {
     mciSendStringA("play mySound", NULL, 0, NULL);
     addToHistory(song);
     printf("\n\nNow Playing: \"%s\" by %s\n", song->title, song->artist);
-    printf("[SPACE] Pause/Resume | [ENTER] Stop | [n] Next | [p] Previous\n");
+    printf("[SPACE] Pause/Resume | [ENTER] Stop | [n] Next | [p] Previous | [<-/->] Seek %ds\n", SEEK_STEP_MS / 1000);
     while (true) {
         if (_kbhit()) {
-            char key = _getch();
+            int key = _getch();
+            if (key == 0 || key == KEY_EXTENDED_PREFIX) { // Arrow keys arrive as a two-byte sequence
+                key = _getch();
+                if (key == KEY_ARROW_LEFT || key == KEY_ARROW_RIGHT) {
+                    mciSendStringA("status mySound position", status, sizeof(status), NULL);
+                    seekSong(atol(status) + (key == KEY_ARROW_RIGHT ? SEEK_STEP_MS : -SEEK_STEP_MS), totalLength, isPaused);
+                }
+                continue;
+            }
             switch (key) {
-                case ' ': isPaused = !isPaused; mciSendStringA(isPaused ? "pause mySound" : "resume mySound", NULL, 0, NULL); break;
+                case ' ': isPaused = !isPaused; mciSendStringA(isPaused ? "pause mySound" : "play mySound", NULL, 0, NULL); break;
                 case '\r': mciSendStringA("close mySound", NULL, 0, NULL); return ACTION_STOP;
                 case 'n': case 'N': mciSendStringA("close mySound", NULL, 0, NULL); return ACTION_NEXT;
                 case 'p': case 'P': mciSendStringA("close mySound", NULL, 0, NULL); return ACTION_PREV;